@@ -0,0 +1,40 @@
+#!/usr/bin/env bash
+#*******************************************************************************
+#*   (c) 2019 ZondaX GmbH
+#*
+#*  Licensed under the Apache License, Version 2.0 (the "License");
+#*  you may not use this file except in compliance with the License.
+#*  You may obtain a copy of the License at
+#*
+#*      http://www.apache.org/licenses/LICENSE-2.0
+#*
+#*  Unless required by applicable law or agreed to in writing, software
+#*  distributed under the License is distributed on an "AS IS" BASIS,
+#*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#*  See the License for the specific language governing permissions and
+#*  limitations under the License.
+#********************************************************************************/
+
+# Compares a benchmark run against a saved baseline
+#
+#   compare.sh <baseline.json> <bench_user|bench_val|contender.json> [benchmark options]
+#
+# A baseline is saved with:
+#   ./bench_user --benchmark_out=baseline.json --benchmark_out_format=json
+
+SCRIPTDIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+BUILDDIR=${BUILDDIR:-$SCRIPTDIR/../..}
+# compare.py comes from the google benchmark release pinned in cmake/benchmark (v1.6.1)
+COMPARE=$BUILDDIR/benchmark-src/tools/compare.py
+
+if [ "$#" -lt 2 ]; then
+  echo "Usage: $0 <baseline.json> <benchmark executable or json> [benchmark options]"
+  exit 1
+fi
+
+if [ ! -f "$COMPARE" ]; then
+  echo "$COMPARE not found. Set BUILDDIR to the cmake build directory."
+  exit 1
+fi
+
+python3 "$COMPARE" benchmarks "$@"
@@ -0,0 +1,65 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "../util/allocations.h"
+#include "util/common.h"
+
+using json = nlohmann::json;
+
+namespace {
+    // Canonical sign bytes the way tests/user/ui_output.cpp builds them: parse into a DOM, dump with sorted keys
+    void BM_Canonicalize_Nlohmann(benchmark::State &state) {
+        const auto &testcases = get_testcases();
+        size_t bytes = 0;
+
+        for (const auto &tc : testcases) {
+            bytes += tc.tx.size();
+        }
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                for (const auto &tc : testcases) {
+                    auto canonical = json::parse(tc.tx).dump();
+                    benchmark::DoNotOptimize(canonical);
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * bytes);
+        state.SetItemsProcessed(state.iterations() * testcases.size());
+    }
+
+    void BM_Canonicalize_Nlohmann_MultiMsg(benchmark::State &state) {
+        const std::string tx = make_tx(state.range(0));
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                auto canonical = json::parse(tx).dump();
+                benchmark::DoNotOptimize(canonical);
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * tx.size());
+    }
+}
+
+BENCHMARK(BM_Canonicalize_Nlohmann);
+BENCHMARK(BM_Canonicalize_Nlohmann_MultiMsg)->RangeMultiplier(2)->Range(1, 64);
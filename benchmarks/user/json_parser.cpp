@@ -0,0 +1,126 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include <lib/json/json_parser.h>
+#include <lib/json/tx_validate.h>
+#include "../util/allocations.h"
+#include "util/common.h"
+
+namespace {
+    size_t corpus_bytes(const std::vector<bench_tx_t> &corpus) {
+        size_t bytes = 0;
+        for (const auto &tc : corpus) {
+            bytes += tc.tx.size();
+        }
+        return bytes;
+    }
+
+    void json_parse_corpus(benchmark::State &state, const std::vector<bench_tx_t> &corpus) {
+        parsed_json_t parsed_json;
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                for (const auto &tc : corpus) {
+                    json_parse(&parsed_json, tc.tx.c_str());
+                    benchmark::DoNotOptimize(parsed_json.numberOfTokens);
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * corpus_bytes(corpus));
+        state.SetItemsProcessed(state.iterations() * corpus.size());
+    }
+
+    void BM_JsonParse_Corpus(benchmark::State &state) {
+        json_parse_corpus(state, get_testcases());
+    }
+
+    void BM_JsonParse_FuzzingInputs(benchmark::State &state) {
+        json_parse_corpus(state, get_fuzzing_inputs());
+    }
+
+    void BM_JsonParse_MultiMsg(benchmark::State &state) {
+        const std::string tx = make_tx(state.range(0));
+        parsed_json_t parsed_json;
+
+        if (json_parse(&parsed_json, tx.c_str()) != parser_ok) {
+            state.SkipWithError("json_parse failed");
+            return;
+        }
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                json_parse(&parsed_json, tx.c_str());
+                benchmark::DoNotOptimize(parsed_json.numberOfTokens);
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * tx.size());
+        state.counters["tokens"] = parsed_json.numberOfTokens;
+    }
+
+    void BM_TxValidate_Corpus(benchmark::State &state) {
+        const auto &testcases = get_testcases();
+
+        // Parse once outside of the timed loop. tx_validate only reads the tokens.
+        std::vector<parsed_json_t> parsed(testcases.size());
+        for (size_t i = 0; i < testcases.size(); i++) {
+            json_parse(&parsed[i], testcases[i].tx.c_str());
+        }
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                for (auto &parsed_json : parsed) {
+                    benchmark::DoNotOptimize(tx_validate(&parsed_json));
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * corpus_bytes(testcases));
+        state.SetItemsProcessed(state.iterations() * testcases.size());
+    }
+
+    void BM_TxValidate_MultiMsg(benchmark::State &state) {
+        const std::string tx = make_tx(state.range(0));
+        parsed_json_t parsed_json;
+
+        if (json_parse(&parsed_json, tx.c_str()) != parser_ok) {
+            state.SkipWithError("json_parse failed");
+            return;
+        }
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(tx_validate(&parsed_json));
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * tx.size());
+    }
+}
+
+BENCHMARK(BM_JsonParse_Corpus);
+BENCHMARK(BM_JsonParse_FuzzingInputs);
+BENCHMARK(BM_JsonParse_MultiMsg)->RangeMultiplier(2)->Range(1, 64);
+BENCHMARK(BM_TxValidate_Corpus);
+BENCHMARK(BM_TxValidate_MultiMsg)->RangeMultiplier(2)->Range(1, 64);
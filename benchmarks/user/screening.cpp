@@ -0,0 +1,58 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <lib/parser.h>
+#include "../../tests/user/util/common.h"
+#include "../util/allocations.h"
+#include "util/common.h"
+
+namespace {
+    // Same sequence as tests/user/ui_output.cpp: parse, validate and render every item of each transaction
+    void BM_Screening_OneAtATime(benchmark::State &state) {
+        const auto &testcases = get_testcases();
+        parser_context_t ctx;
+        size_t bytes = 0;
+        size_t lines = 0;
+
+        for (const auto &tc : testcases) {
+            bytes += tc.tx.size();
+        }
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                for (const auto &tc : testcases) {
+                    parser_error_t err = parser_parse(&ctx, (const uint8_t *) tc.tx.c_str(), (uint16_t) tc.tx.size());
+                    if (err != parser_ok)
+                        continue;
+
+                    err = parser_validate(&ctx);
+                    benchmark::DoNotOptimize(err);
+
+                    auto output = dumpUI(&ctx, 40, 40);
+                    lines += output.size();
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * bytes);
+        state.SetItemsProcessed(state.iterations() * testcases.size());
+        state.counters["lines/s"] = benchmark::Counter(lines, benchmark::Counter::kIsRate);
+    }
+}
+
+BENCHMARK(BM_Screening_OneAtATime);
@@ -0,0 +1,71 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <lib/parser.h>
+#include "../util/allocations.h"
+#include "util/common.h"
+
+namespace {
+    // parser_parse keeps the transaction being displayed in global state,
+    // so each transaction has to be parsed again right before its items are fetched.
+    // BM_ParserParse_Corpus measures that part alone.
+
+    void BM_ParserParse_Corpus(benchmark::State &state) {
+        const auto &testcases = get_testcases();
+        parser_context_t ctx;
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                for (const auto &tc : testcases) {
+                    benchmark::DoNotOptimize(
+                        parser_parse(&ctx, (const uint8_t *) tc.tx.c_str(), (uint16_t) tc.tx.size()));
+                }
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * testcases.size());
+    }
+
+    // Fetches every page of every item in the corpus. The argument is the display width for values.
+    void BM_GetAllItems_Corpus(benchmark::State &state) {
+        const auto &testcases = get_testcases();
+        const auto maxValueLen = (uint16_t) state.range(0);
+        parser_context_t ctx;
+        size_t pages = 0;
+        size_t errors = 0;
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                for (const auto &tc : testcases) {
+                    parser_error_t err = parser_parse(&ctx, (const uint8_t *) tc.tx.c_str(), (uint16_t) tc.tx.size());
+                    if (err != parser_ok)
+                        continue;
+                    pages += page_all_items(&ctx, 40, maxValueLen, &errors);
+                }
+            }
+        }
+
+        // Items that failed to render are not counted as pages
+        state.counters["pages/s"] = benchmark::Counter(pages, benchmark::Counter::kIsRate);
+        state.counters["errors"] = benchmark::Counter(errors, benchmark::Counter::kAvgIterations);
+    }
+}
+
+BENCHMARK(BM_ParserParse_Corpus);
+BENCHMARK(BM_GetAllItems_Corpus)->Arg(40)->Arg(17);
@@ -0,0 +1,93 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <lib/parser.h>
+#include "../util/allocations.h"
+#include "util/common.h"
+
+namespace {
+    void BM_PageAllItems(benchmark::State &state) {
+        const std::string tx = make_tx(state.range(0));
+
+        parser_context_t ctx;
+        if (!parse_or_skip(state, &ctx, tx))
+            return;
+
+        // Every item of the generated transaction must render, so a failure is not timed as a page
+        size_t errors = 0;
+        page_all_items(&ctx, 40, 40, &errors);
+        if (errors > 0) {
+            state.SkipWithError("parser_getItem failed");
+            return;
+        }
+
+        size_t pages = 0;
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                pages += page_all_items(&ctx, 40, 40, &errors);
+            }
+        }
+
+        state.counters["items"] = parser_getNumItems(&ctx);
+        state.counters["pages/s"] = benchmark::Counter(pages, benchmark::Counter::kIsRate);
+    }
+
+    // Cost of reaching the last item alone, which is where a walk from the root is most expensive
+    void BM_GetLastItem(benchmark::State &state) {
+        const std::string tx = make_tx(state.range(0));
+
+        parser_context_t ctx;
+        if (!parse_or_skip(state, &ctx, tx))
+            return;
+
+        const uint16_t numItems = parser_getNumItems(&ctx);
+        if (numItems == 0) {
+            state.SkipWithError("Transaction has no items");
+            return;
+        }
+
+        char keyBuffer[100];
+        char valueBuffer[100];
+        uint8_t pageCount = 0;
+        const uint16_t lastItem = numItems - 1;
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                const parser_error_t err = parser_getItem(&ctx, lastItem,
+                                                          keyBuffer, sizeof(keyBuffer),
+                                                          valueBuffer, sizeof(valueBuffer),
+                                                          0, &pageCount);
+                if (err != parser_ok) {
+                    state.SkipWithError(parser_getErrorDescription(err));
+                    break;
+                }
+                benchmark::DoNotOptimize(valueBuffer);
+            }
+        }
+
+        state.counters["items"] = parser_getNumItems(&ctx);
+    }
+}
+
+// 4 msgs is the 22-item transaction in TxParse.Page_Count_MultipleMsgs
+// 335 msgs is the largest make_tx that fits the uint16_t length taken by parser_parse:
+// 139 bytes of header + 17 of footer + 335 * 194 bytes of msgs + 334 commas = 65480 <= 65535
+BENCHMARK(BM_PageAllItems)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Arg(335);
+BENCHMARK(BM_GetLastItem)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Arg(335);
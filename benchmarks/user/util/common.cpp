@@ -0,0 +1,144 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <algorithm>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+#include "common.h"
+
+using json = nlohmann::json;
+
+namespace {
+    const char *TX_HEADER =
+        R"({"account_number":"0","chain_id":"test-chain-1","fee":{"amount":[{"amount":"5","denom":"photon"}],"gas":"10000"},"memo":"testmemo","msgs":[)";
+
+    const char *TX_MSG =
+        R"({"inputs":[{"address":"cosmosaccaddr1d9h8qat5e4ehc5","coins":[{"amount":"10","denom":"atom"}]}],"outputs":[{"address":"cosmosaccaddr1da6hgur4wse3jx32","coins":[{"amount":"10","denom":"atom"}]}]})";
+
+    const char *TX_FOOTER = R"(],"sequence":"1"})";
+
+    std::vector<bench_tx_t> load_testcases() {
+        auto answer = std::vector<bench_tx_t>();
+
+        json j;
+        std::ifstream inFile(TESTCASES_PATH);
+        if (!inFile.is_open())
+            throw std::runtime_error("Could not open " TESTCASES_PATH);
+        inFile >> j;
+
+        for (auto &item : j) {
+            answer.push_back(bench_tx_t{item["name"], item["tx"].dump()});
+        }
+
+        return answer;
+    }
+
+    std::vector<bench_tx_t> load_fuzzing_inputs() {
+        auto answer = std::vector<bench_tx_t>();
+
+        DIR *dir = opendir(FUZZING_INPUTS_PATH);
+        if (dir == nullptr)
+            throw std::runtime_error("Could not open " FUZZING_INPUTS_PATH);
+
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != nullptr) {
+            const std::string name = entry->d_name;
+            if (name[0] == '.')
+                continue;
+
+            // The whole file, since memos contain spaces. Only the trailing newline is dropped.
+            std::ifstream inFile(std::string(FUZZING_INPUTS_PATH) + "/" + name, std::ios::binary);
+            std::string input((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+            if (!input.empty() && input.back() == '\n') {
+                input.pop_back();
+            }
+            answer.push_back(bench_tx_t{name, input});
+        }
+        closedir(dir);
+
+        std::sort(answer.begin(), answer.end(),
+                  [](const bench_tx_t &a, const bench_tx_t &b) { return a.name < b.name; });
+
+        return answer;
+    }
+}
+
+const std::vector<bench_tx_t> &get_testcases() {
+    static const std::vector<bench_tx_t> testcases = load_testcases();
+    return testcases;
+}
+
+const std::vector<bench_tx_t> &get_fuzzing_inputs() {
+    static const std::vector<bench_tx_t> inputs = load_fuzzing_inputs();
+    return inputs;
+}
+
+std::string make_tx(size_t numMsgs) {
+    std::string tx = TX_HEADER;
+    for (size_t i = 0; i < numMsgs; i++) {
+        if (i > 0) {
+            tx += ",";
+        }
+        tx += TX_MSG;
+    }
+    tx += TX_FOOTER;
+    return tx;
+}
+
+bool parse_or_skip(benchmark::State &state, parser_context_t *ctx, const std::string &tx) {
+    if (tx.size() > UINT16_MAX) {
+        state.SkipWithError("Transaction does not fit in a uint16_t length");
+        return false;
+    }
+
+    parser_error_t err = parser_parse(ctx, (const uint8_t *) tx.c_str(), (uint16_t) tx.size());
+    if (err != parser_ok) {
+        state.SkipWithError(parser_getErrorDescription(err));
+        return false;
+    }
+
+    return true;
+}
+
+size_t page_all_items(parser_context_t *ctx, uint16_t maxKeyLen, uint16_t maxValueLen, size_t *errors) {
+    char keyBuffer[1000];
+    char valueBuffer[1000];
+    size_t pages = 0;
+
+    const uint16_t numItems = parser_getNumItems(ctx);
+    for (uint16_t idx = 0; idx < numItems; idx++) {
+        uint8_t pageIdx = 0;
+        uint8_t pageCount = 1;
+        while (pageIdx < pageCount) {
+            const parser_error_t err = parser_getItem(ctx, idx,
+                                                      keyBuffer, maxKeyLen,
+                                                      valueBuffer, maxValueLen,
+                                                      pageIdx, &pageCount);
+            if (err != parser_ok) {
+                (*errors)++;
+                break;
+            }
+            benchmark::DoNotOptimize(valueBuffer);
+            pageIdx++;
+            pages++;
+        }
+    }
+
+    return pages;
+}
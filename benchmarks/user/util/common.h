@@ -0,0 +1,43 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <lib/parser.h>
+#include <string>
+#include <vector>
+
+typedef struct {
+    std::string name;
+    std::string tx;
+} bench_tx_t;
+
+// Transactions from tests/user/testcases.json, serialized the same way tests/user/ui_output.cpp does
+const std::vector<bench_tx_t> &get_testcases();
+
+// Seed inputs in fuzzing/inputs, each file read whole without its trailing newline
+const std::vector<bench_tx_t> &get_fuzzing_inputs();
+
+// Same layout as TxParse.Page_Count_MultipleMsgs, with a configurable number of msgs
+std::string make_tx(size_t numMsgs);
+
+// Runs parser_parse and marks the benchmark as failed if the transaction is rejected
+bool parse_or_skip(benchmark::State &state, parser_context_t *ctx, const std::string &tx);
+
+// Fetches every page of every item, as the device UI does when scrolling through a transaction.
+// Returns the number of pages rendered. Items that fail to render are added to errors and not paged further.
+size_t page_all_items(parser_context_t *ctx, uint16_t maxKeyLen, uint16_t maxValueLen, size_t *errors);
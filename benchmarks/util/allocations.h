@@ -0,0 +1,38 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+// Number of C++ heap allocations since the process started
+uint64_t allocations_count();
+
+// Reports the allocations made during the timed loop as an "allocs" counter (per iteration)
+class AllocationsCounter {
+public:
+    explicit AllocationsCounter(benchmark::State &state) : state_(state), start_(allocations_count()) {}
+
+    ~AllocationsCounter() {
+        state_.counters["allocs"] = benchmark::Counter(allocations_count() - start_,
+                                                       benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State &state_;
+    uint64_t start_;
+};
@@ -0,0 +1,63 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "lib/vote_parser.h"
+#include "../util/allocations.h"
+
+namespace {
+    // Run of varints whose encoded length cycles from 1 to 5 bytes
+    std::vector<uint8_t> make_varints(size_t count, size_t *numVarints) {
+        const size_t values[] = {0x34, 300, 0x1FFFFF, 0xFFFFFFF, 2959127534};
+
+        std::vector<uint8_t> data;
+        for (size_t i = 0; i < count; i++) {
+            size_t v = values[i % 5];
+            while (v >= 0x80) {
+                data.push_back((uint8_t) (v | 0x80));
+                v >>= 7;
+            }
+            data.push_back((uint8_t) v);
+        }
+
+        *numVarints = count;
+        return data;
+    }
+
+    void BM_GetVarint(benchmark::State &state) {
+        size_t numVarints = 0;
+        const auto data = make_varints(state.range(0), &numVarints);
+
+        size_t value;
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                uint32_t pos = 0;
+                while (pos < data.size()) {
+                    if (get_varint(data.data(), data.size(), &value, pos, &pos) != parse_ok)
+                        break;
+                    benchmark::DoNotOptimize(value);
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * data.size());
+        state.SetItemsProcessed(state.iterations() * numVarints);
+    }
+}
+
+BENCHMARK(BM_GetVarint)->Arg(5)->Arg(1000);
@@ -0,0 +1,133 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "lib/vote_fsm.h"
+#include "lib/vote_parser.h"
+#include "../util/allocations.h"
+#include "../../signer/signRequest.h"
+#include "../../signer/voteEncoder.h"
+#include "../../signer/voteStream.h"
+
+namespace {
+    void init_state() {
+        vote_reset();
+        vote_state_reset();
+
+        vote_state.isInitialized = 1;
+        vote_state.vote.Type = TYPE_PROPOSAL;
+        vote_state.vote.Height = 0;
+        vote_state.vote.Round = 0;
+    }
+
+    size_t stream_bytes(const std::vector<stream_request_t> &stream) {
+        size_t bytes = 0;
+        for (const auto &req : stream) {
+            bytes += req.data.size();
+        }
+        return bytes;
+    }
+
+    // Every request moves to the next height, so every transition is accepted
+    void BM_TryStateTransition_Accepted(benchmark::State &state) {
+        init_state();
+
+        int64_t height = 0;
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                vote.Type = TYPE_PREVOTE;
+                vote.Height = ++height;
+                vote.Round = 0;
+                benchmark::DoNotOptimize(try_state_transition());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // The same request is repeated, so every transition is rejected
+    void BM_TryStateTransition_Rejected(benchmark::State &state) {
+        init_state();
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                vote.Type = TYPE_PROPOSAL;
+                vote.Height = 0;
+                vote.Round = 0;
+                benchmark::DoNotOptimize(try_state_transition());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Full validator path: decode the signed bytes, check them against the current state and commit accepted votes
+    void BM_ParseAndTransition(benchmark::State &state) {
+        std::vector<std::vector<uint8_t>> votes;
+        size_t bytes = 0;
+        for (int64_t height = 1; height <= state.range(0); height++) {
+            votes.push_back(make_vote(TYPE_PREVOTE, height, 0));
+            votes.push_back(make_vote(TYPE_PRECOMMIT, height, 0));
+        }
+        for (const auto &v : votes) {
+            bytes += v.size();
+        }
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                init_state();
+                for (const auto &v : votes) {
+                    benchmark::DoNotOptimize(sign_request(v.data(), v.size()));
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * bytes);
+        state.SetItemsProcessed(state.iterations() * votes.size());
+    }
+
+    // Generated consensus stream, including duplicates, stale requests and equivocation attempts
+    void BM_ReplayStream(benchmark::State &state) {
+        stream_options_t opt;
+        opt.heights = state.range(0);
+        const auto stream = generate_stream(opt);
+
+        size_t transitions = 0;
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                vote_reset();
+                vote_state_reset();
+                for (const auto &req : stream) {
+                    transitions += sign_request(req.data.data(), req.data.size()) == sign_accepted ? 1 : 0;
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * stream_bytes(stream));
+        state.SetItemsProcessed(state.iterations() * stream.size());
+        state.counters["transitions/s"] = benchmark::Counter(transitions, benchmark::Counter::kIsRate);
+    }
+}
+
+BENCHMARK(BM_TryStateTransition_Accepted);
+BENCHMARK(BM_TryStateTransition_Rejected);
+BENCHMARK(BM_ParseAndTransition)->Arg(1)->Arg(100)->Arg(10000);
+BENCHMARK(BM_ReplayStream)->Arg(100)->Arg(10000);
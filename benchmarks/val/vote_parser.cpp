@@ -0,0 +1,68 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "lib/vote_parser.h"
+#include "../util/allocations.h"
+#include "../../signer/voteEncoder.h"
+
+namespace {
+    void BM_VoteAminoParse_RealProposal(benchmark::State &state) {
+        const auto &data = real_proposal();
+        vote_t vote;
+
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(vote_amino_parse(data.data(), data.size(), &vote));
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * data.size());
+    }
+
+    void BM_VoteAminoParse_Generated(benchmark::State &state) {
+        // Consecutive heights, each with a prevote and a precommit in a few rounds
+        std::vector<std::vector<uint8_t>> votes;
+        size_t bytes = 0;
+        for (int64_t height = 1; height <= state.range(0); height++) {
+            for (int64_t round = 0; round < 3; round++) {
+                votes.push_back(make_vote(TYPE_PREVOTE, height, round));
+                votes.push_back(make_vote(TYPE_PRECOMMIT, height, round));
+            }
+        }
+        for (const auto &v : votes) {
+            bytes += v.size();
+        }
+
+        vote_t vote;
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                for (const auto &v : votes) {
+                    benchmark::DoNotOptimize(vote_amino_parse(v.data(), v.size(), &vote));
+                }
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * bytes);
+        state.SetItemsProcessed(state.iterations() * votes.size());
+    }
+}
+
+BENCHMARK(BM_VoteAminoParse_RealProposal);
+BENCHMARK(BM_VoteAminoParse_Generated)->Arg(1)->Arg(100)->Arg(10000);
@@ -0,0 +1,114 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "lib/vote_fsm.h"
+#include "lib/vote_parser.h"
+#include "../util/allocations.h"
+#include "../../signer/signRequest.h"
+#include "../../signer/voteStream.h"
+#include "../../signer/voteStateStore.h"
+
+///
+/// Durable counterpart of BM_ReplayStream (vote_fsm.cpp), built on Unix only
+///
+
+namespace {
+    // State files go to TMPDIR, which should be on the disk the signer would use
+    std::string state_file_path() {
+        const char *dir = getenv("TMPDIR");
+        return std::string(dir != nullptr ? dir : "/tmp") + "/bench_val_vote_state.bin";
+    }
+
+    // The stream of BM_ReplayStream, saving vote_state to a state file after every accepted request.
+    // range(1) is the number of saves per msync, 0 leaves write-back to the OS.
+    void BM_ReplayStream_Persisted(benchmark::State &state) {
+        stream_options_t opt;
+        opt.heights = state.range(0);
+        const auto stream = generate_stream(opt);
+
+        size_t bytes = 0;
+        for (const auto &req : stream) {
+            bytes += req.data.size();
+        }
+
+        const std::string path = state_file_path();
+        std::remove(path.c_str());
+
+        vote_state_store_t store;
+        if (!vote_state_store_open(&store, path.c_str(), (uint32_t) state.range(1))) {
+            state.SkipWithError("Could not open the state file");
+            return;
+        }
+
+        size_t transitions = 0;
+        {
+            AllocationsCounter allocs(state);
+            for (auto _ : state) {
+                vote_reset();
+                vote_state_reset();
+                for (const auto &req : stream) {
+                    if (sign_request(req.data.data(), req.data.size()) == sign_accepted) {
+                        vote_state_store_save(&store);
+                        transitions++;
+                    }
+                }
+            }
+        }
+
+        vote_state_store_close(&store);
+        std::remove(path.c_str());
+
+        state.SetBytesProcessed(state.iterations() * bytes);
+        state.SetItemsProcessed(state.iterations() * stream.size());
+        state.counters["transitions/s"] = benchmark::Counter(transitions, benchmark::Counter::kIsRate);
+    }
+
+    // Startup cost: map the state file and bring back the saved vote_state
+    void BM_RestoreState(benchmark::State &state) {
+        const std::string path = state_file_path();
+        std::remove(path.c_str());
+
+        vote_state_store_t store;
+        if (!vote_state_store_open(&store, path.c_str(), 1)) {
+            state.SkipWithError("Could not open the state file");
+            return;
+        }
+        vote_state_reset();
+        vote_state.isInitialized = 1;
+        vote_state.vote.Type = TYPE_PRECOMMIT;
+        vote_state.vote.Height = 1000;
+        vote_state.vote.Round = 0;
+        vote_state_store_save(&store);
+        vote_state_store_close(&store);
+
+        for (auto _ : state) {
+            vote_state_store_open(&store, path.c_str(), 1);
+            benchmark::DoNotOptimize(vote_state_store_load(&store));
+            vote_state_store_close(&store);
+        }
+
+        std::remove(path.c_str());
+    }
+}
+
+// Durability off (no msync), msync every 64 accepted votes, then msync after each one
+BENCHMARK(BM_ReplayStream_Persisted)->Args({10000, 0})->Args({10000, 64})->Args({1000, 1});
+BENCHMARK(BM_RestoreState);
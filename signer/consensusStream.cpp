@@ -0,0 +1,116 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "lib/vote_fsm.h"
+#include "signRequest.h"
+#include "voteStream.h"
+#include "streamOptions.h"
+
+///
+/// Generates consensus stream files and replays them through vote_amino_parse and try_state_transition
+///
+
+namespace {
+    void usage(const char *name) {
+        fprintf(stderr,
+                "Usage: %s generate [options] FILE\n"
+                "       %s replay FILE\n"
+                "%s",
+                name, name, STREAM_OPTIONS_HELP);
+    }
+
+    int generate(const char *name, int argc, char **argv) {
+        stream_options_t opt;
+        const auto long_options = stream_long_options({});
+
+        int c;
+        while ((c = getopt_long(argc, argv, STREAM_SHORT_OPTIONS, long_options.data(), nullptr)) != -1) {
+            if (!stream_option_parse(c, optarg, &opt)) {
+                usage(name);
+                return 1;
+            }
+        }
+
+        if (optind >= argc) {
+            usage(name);
+            return 1;
+        }
+
+        const auto stream = generate_stream(opt);
+        if (!write_stream(argv[optind], stream)) {
+            fprintf(stderr, "Could not write %s\n", argv[optind]);
+            return 1;
+        }
+
+        printf("%zu requests written to %s\n", stream.size(), argv[optind]);
+        return 0;
+    }
+
+    int replay(const char *path) {
+        std::vector<stream_request_t> stream;
+        if (!read_stream(path, stream)) {
+            fprintf(stderr, "Could not read %s\n", path);
+            return 1;
+        }
+
+        vote_reset();
+        vote_state_reset();
+
+        size_t counts[3] = {0, 0, 0};
+        size_t mismatches = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < stream.size(); i++) {
+            const auto &req = stream[i];
+            const sign_status_t status = sign_request(req.data.data(), req.data.size());
+
+            counts[status]++;
+            if (status != req.expected) {
+                if (mismatches == 0) {
+                    fprintf(stderr, "First unexpected decision at request %zu\n", i);
+                }
+                mismatches++;
+            }
+        }
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        printf("requests    %zu\n", stream.size());
+        printf("accepted    %zu\n", counts[sign_accepted]);
+        printf("rejected    %zu\n", counts[sign_rejected]);
+        printf("invalid     %zu\n", counts[sign_invalid]);
+        printf("unexpected  %zu\n", mismatches);
+        printf("throughput  %.0f req/s\n", stream.size() / elapsed);
+
+        return mismatches == 0 ? 0 : 2;
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc >= 3 && strcmp(argv[1], "generate") == 0) {
+        return generate(argv[0], argc - 1, argv + 1);
+    }
+
+    if (argc == 3 && strcmp(argv[1], "replay") == 0) {
+        return replay(argv[2]);
+    }
+
+    usage(argv[0]);
+    return 1;
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <unistd.h>
+#include <vector>
+#include "signRequest.h"
+#include "voteStream.h"
+#include "streamOptions.h"
+#include "transport.h"
+
+///
+/// Replays a synthetic consensus stream against signer_stub and reports sign latency
+///
+
+namespace {
+    double percentile(const std::vector<double> &sorted, double p) {
+        if (sorted.empty())
+            return 0;
+        size_t idx = (size_t) (p * (sorted.size() - 1));
+        return sorted[idx];
+    }
+
+    void usage(const char *name) {
+        fprintf(stderr,
+                "Usage: %s [options] unix:<path> | tcp:<host>:<port>\n"
+                "  -i, --input FILE         replay a stream written by consensus_stream\n"
+                "%s",
+                name, STREAM_OPTIONS_HELP);
+    }
+}
+
+int main(int argc, char **argv) {
+    stream_options_t opt;
+    const char *input = nullptr;
+
+    const auto long_options = stream_long_options({
+        {"input", required_argument, nullptr, 'i'},
+    });
+
+    int c;
+    while ((c = getopt_long(argc, argv, "i:" STREAM_SHORT_OPTIONS, long_options.data(), nullptr)) != -1) {
+        if (c == 'i') {
+            input = optarg;
+        } else if (!stream_option_parse(c, optarg, &opt)) {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (optind >= argc) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<stream_request_t> stream;
+    if (input != nullptr) {
+        if (!read_stream(input, stream)) {
+            fprintf(stderr, "Could not read %s\n", input);
+            return 1;
+        }
+    } else {
+        stream = generate_stream(opt);
+    }
+
+    int fd = transport_connect(argv[optind]);
+    if (fd < 0)
+        return 1;
+
+    std::vector<double> latencies;
+    latencies.reserve(stream.size());
+    size_t counts[3] = {0, 0, 0};
+    size_t mismatches = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto &req : stream) {
+        const auto t0 = std::chrono::steady_clock::now();
+
+        uint8_t status;
+        if (!transport_write_all(fd, req.data.data(), req.data.size()) ||
+            !transport_read_all(fd, &status, 1)) {
+            fprintf(stderr, "Connection lost after %zu requests\n", latencies.size());
+            close(fd);
+            return 1;
+        }
+
+        const auto t1 = std::chrono::steady_clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+
+        if (status <= sign_invalid)
+            counts[status]++;
+        if (status != req.expected)
+            mismatches++;
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    close(fd);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("requests    %zu\n", stream.size());
+    printf("accepted    %zu\n", counts[sign_accepted]);
+    printf("rejected    %zu\n", counts[sign_rejected]);
+    printf("invalid     %zu\n", counts[sign_invalid]);
+    printf("unexpected  %zu\n", mismatches);
+    printf("throughput  %.0f req/s\n", stream.size() / elapsed);
+    printf("latency     p50 %.1f us  p99 %.1f us  p999 %.1f us  max %.1f us\n",
+           percentile(latencies, 0.50),
+           percentile(latencies, 0.99),
+           percentile(latencies, 0.999),
+           latencies.empty() ? 0 : latencies.back());
+
+    return mismatches == 0 ? 0 : 2;
+}
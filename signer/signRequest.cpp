@@ -0,0 +1,59 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include "lib/vote_fsm.h"
+#include "lib/vote_parser.h"
+#include "signRequest.h"
+
+sign_status_t sign_request(const uint8_t *data, size_t size) {
+    if (vote_amino_parse(data, size, &vote) != parse_ok)
+        return sign_invalid;
+
+    if (!vote_state.isInitialized) {
+        vote_state.vote = vote;
+        vote_state.isInitialized = 1;
+        return sign_accepted;
+    }
+
+    if (!try_state_transition())
+        return sign_rejected;
+
+    vote_state.vote = vote;
+    return sign_accepted;
+}
+
+bool read_sign_bytes(const std::function<bool(uint8_t *, size_t)> &read, std::vector<uint8_t> &data) {
+    data.clear();
+
+    // uvarint length prefix
+    size_t length = 0;
+    uint8_t shift = 0;
+    uint8_t b;
+    do {
+        if (shift > 28 || !read(&b, 1))
+            return false;
+        data.push_back(b);
+        length |= (size_t) (b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+
+    if (length > SIGN_REQUEST_MAX_SIZE - data.size())
+        return false;
+
+    const size_t prefixLen = data.size();
+    data.resize(prefixLen + length);
+    return read(data.data() + prefixLen, length);
+}
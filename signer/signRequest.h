@@ -0,0 +1,43 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+///
+/// Sign requests handled the way the validator app does, shared by the signer harness, test_val and bench_val
+///
+
+// Largest sign request read from a stream file or a socket, uvarint length prefix included
+#define SIGN_REQUEST_MAX_SIZE 1024
+
+typedef enum {
+    sign_accepted = 0,          // the vote would be signed
+    sign_rejected = 1,          // refused by try_state_transition
+    sign_invalid = 2,           // refused by vote_amino_parse
+} sign_status_t;
+
+// Handles a sign request the way the validator app does: vote_amino_parse, then try_state_transition.
+// The first vote after vote_state_reset initializes the state (the device asks the user to confirm it).
+sign_status_t sign_request(const uint8_t *data, size_t size);
+
+// Reads sign bytes (uvarint length prefix + amino vote) with read(buffer, len). The prefix is kept at the start of data.
+// Fails if read fails or the request is larger than SIGN_REQUEST_MAX_SIZE.
+bool read_sign_bytes(const std::function<bool(uint8_t *, size_t)> &read, std::vector<uint8_t> &data);
@@ -0,0 +1,136 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+#include "lib/vote_fsm.h"
+#include "signRequest.h"
+#include "transport.h"
+#include "voteStateStore.h"
+
+///
+/// Host stand-in for the validator app, used to drive val_lib with signer_loadgen
+///
+/// Requests are decoded with vote_amino_parse and checked with try_state_transition, as the device does.
+/// No signature is produced: there is no software ed25519 key in this repository.
+///
+
+namespace {
+    void usage(const char *name) {
+        fprintf(stderr,
+                "Usage: %s [options] unix:<path> | tcp:<host>:<port>\n"
+                "  -f, --state FILE         keep vote_state in FILE across connections and restarts\n"
+                "  -n, --sync-every N       flush FILE to disk every N accepted votes, 0 to leave it to the OS (default 1)\n",
+                name);
+    }
+
+    // An accepted vote is only answered once it is saved. If that fails the stub stops, rather than sign a
+    // vote it could sign again after a restart.
+    void serve(int fd, vote_state_store_t *store) {
+        std::vector<uint8_t> frame;
+        frame.reserve(SIGN_REQUEST_MAX_SIZE);
+
+        while (transport_read_frame(fd, frame)) {
+            const uint8_t status = sign_request(frame.data(), frame.size());
+            if (status == sign_accepted && store != nullptr && !vote_state_store_save(store)) {
+                fprintf(stderr, "Could not save vote_state\n");
+                exit(1);
+            }
+            if (!transport_write_all(fd, &status, 1))
+                return;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *statePath = nullptr;
+    unsigned long syncEvery = 1;
+
+    const struct option long_options[] = {
+        {"state", required_argument, nullptr, 'f'},
+        {"sync-every", required_argument, nullptr, 'n'},
+        {nullptr, 0, nullptr, 0}
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "f:n:", long_options, nullptr)) != -1) {
+        char *end = nullptr;
+        switch (c) {
+            case 'f':
+                statePath = optarg;
+                break;
+            case 'n':
+                syncEvery = strtoul(optarg, &end, 10);
+                if (*optarg < '0' || *optarg > '9' || *end != '\0' || syncEvery > UINT32_MAX) {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (optind >= argc) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    vote_state_store_t store;
+    if (statePath != nullptr) {
+        if (!vote_state_store_open(&store, statePath, (uint32_t) syncEvery))
+            return 1;
+
+        vote_state_reset();
+        if (vote_state_store_load(&store)) {
+            fprintf(stderr, "Restored vote_state from %s: height %lld round %lld type %d\n", statePath,
+                    (long long) vote_state.vote.Height, (long long) vote_state.vote.Round,
+                    (int) vote_state.vote.Type);
+        } else {
+            fprintf(stderr, "No vote_state in %s, the first vote initializes it\n", statePath);
+        }
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+
+    int server = transport_listen(argv[optind]);
+    if (server < 0)
+        return 1;
+
+    fprintf(stderr, "Listening on %s\n", argv[optind]);
+
+    // val_lib keeps its state in globals, so connections are served one at a time.
+    // Without a state file, each connection starts from an uninitialized state, as after restarting the app.
+    // With one, each connection starts from the saved state, as after restarting a signer that persists it.
+    while (true) {
+        int client = accept(server, nullptr, nullptr);
+        if (client < 0)
+            continue;
+        vote_reset();
+        vote_state_reset();
+        if (statePath != nullptr) {
+            vote_state_store_load(&store);
+        }
+        serve(client, statePath != nullptr ? &store : nullptr);
+        close(client);
+    }
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include "streamOptions.h"
+
+const char *STREAM_OPTIONS_HELP =
+    "  -H, --heights N          number of heights (default 1000)\n"
+    "  -r, --rounds N           rounds each height goes through before it can commit (default 1)\n"
+    "  -c, --round-change P     percentage of rounds that fail, below 100 (default 10)\n"
+    "  -j, --height-jump P      percentage of heights followed by a jump (default 2)\n"
+    "  -d, --duplicates P       percentage of duplicated requests (default 5)\n"
+    "  -o, --stale P            percentage of out-of-order requests (default 5)\n"
+    "  -e, --equivocations P    percentage of conflicting votes (default 2)\n"
+    "  -m, --malformed P        percentage of requests followed by one that fails to parse (default 1)\n"
+    "  -s, --seed N             random seed (default 0)\n";
+
+namespace {
+    // Accepts decimal numbers only, so that "-1" is not wrapped around by strtoull
+    bool parse_number(const char *arg, uint64_t min, uint64_t max, uint64_t *value) {
+        if (arg == nullptr || !isdigit((unsigned char) arg[0]))
+            return false;
+
+        char *end;
+        errno = 0;
+        const unsigned long long v = strtoull(arg, &end, 10);
+        if (errno != 0 || *end != '\0' || v < min || v > max)
+            return false;
+
+        *value = v;
+        return true;
+    }
+
+    bool parse_percentage(const char *arg, unsigned max, unsigned *pct) {
+        uint64_t v;
+        if (!parse_number(arg, 0, max, &v))
+            return false;
+        *pct = (unsigned) v;
+        return true;
+    }
+}
+
+std::vector<struct option> stream_long_options(std::vector<struct option> options) {
+    options.insert(options.end(), {
+        {"heights", required_argument, nullptr, 'H'},
+        {"rounds", required_argument, nullptr, 'r'},
+        {"round-change", required_argument, nullptr, 'c'},
+        {"height-jump", required_argument, nullptr, 'j'},
+        {"duplicates", required_argument, nullptr, 'd'},
+        {"stale", required_argument, nullptr, 'o'},
+        {"equivocations", required_argument, nullptr, 'e'},
+        {"malformed", required_argument, nullptr, 'm'},
+        {"seed", required_argument, nullptr, 's'},
+        {nullptr, 0, nullptr, 0}
+    });
+    return options;
+}
+
+bool stream_option_parse(int c, const char *arg, stream_options_t *opt) {
+    uint64_t v;
+
+    switch (c) {
+        case 'H':
+            if (!parse_number(arg, 1, STREAM_MAX_HEIGHTS, &v))
+                return false;
+            opt->heights = (int64_t) v;
+            return true;
+        case 'r':
+            if (!parse_number(arg, 1, STREAM_MAX_ROUNDS, &v))
+                return false;
+            opt->rounds = (int64_t) v;
+            return true;
+        case 'c':
+            return parse_percentage(arg, 99, &opt->roundChange);
+        case 'j':
+            return parse_percentage(arg, 100, &opt->heightJump);
+        case 'd':
+            return parse_percentage(arg, 100, &opt->duplicates);
+        case 'o':
+            return parse_percentage(arg, 100, &opt->stale);
+        case 'e':
+            return parse_percentage(arg, 100, &opt->equivocations);
+        case 'm':
+            return parse_percentage(arg, 100, &opt->malformed);
+        case 's':
+            if (!parse_number(arg, 0, UINT32_MAX, &v))
+                return false;
+            opt->seed = (uint32_t) v;
+            return true;
+        default:
+            return false;
+    }
+}
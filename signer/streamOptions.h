@@ -0,0 +1,37 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#pragma once
+
+#include <getopt.h>
+#include <vector>
+#include "voteStream.h"
+
+///
+/// Command line options for stream_options_t, shared by consensus_stream and signer_loadgen
+///
+
+// Short options handled by stream_option_parse
+#define STREAM_SHORT_OPTIONS "H:r:c:j:d:o:e:m:s:"
+
+// Usage lines for the options above
+extern const char *STREAM_OPTIONS_HELP;
+
+// Appends the long options handled by stream_option_parse to the tool's own, followed by the terminating entry
+std::vector<struct option> stream_long_options(std::vector<struct option> options);
+
+// Applies one getopt_long result to opt. Returns false if c is not a stream option or its value is out of range.
+bool stream_option_parse(int c, const char *arg, stream_options_t *opt);
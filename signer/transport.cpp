@@ -0,0 +1,193 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "signRequest.h"
+#include "transport.h"
+
+namespace {
+    const char *UNIX_PREFIX = "unix:";
+    const char *TCP_PREFIX = "tcp:";
+
+    bool starts_with(const std::string &s, const char *prefix) {
+        return s.compare(0, strlen(prefix), prefix) == 0;
+    }
+
+    bool unix_address(const std::string &path, struct sockaddr_un *sa) {
+        if (path.size() >= sizeof(sa->sun_path)) {
+            fprintf(stderr, "Socket path too long: %s\n", path.c_str());
+            return false;
+        }
+        memset(sa, 0, sizeof(*sa));
+        sa->sun_family = AF_UNIX;
+        strncpy(sa->sun_path, path.c_str(), sizeof(sa->sun_path) - 1);
+        return true;
+    }
+
+    struct addrinfo *tcp_address(const std::string &hostport, bool passive) {
+        const size_t colon = hostport.rfind(':');
+        if (colon == std::string::npos) {
+            fprintf(stderr, "Expected tcp:<host>:<port>, got tcp:%s\n", hostport.c_str());
+            return nullptr;
+        }
+
+        const std::string host = hostport.substr(0, colon);
+        const std::string port = hostport.substr(colon + 1);
+
+        struct addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = passive ? AI_PASSIVE : 0;
+
+        struct addrinfo *result = nullptr;
+        int err = getaddrinfo(host.c_str(), port.c_str(), &hints, &result);
+        if (err != 0) {
+            fprintf(stderr, "getaddrinfo(%s): %s\n", hostport.c_str(), gai_strerror(err));
+            return nullptr;
+        }
+        return result;
+    }
+
+    void set_nodelay(int fd) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+}
+
+int transport_listen(const char *addr) {
+    const std::string s = addr;
+
+    if (starts_with(s, UNIX_PREFIX)) {
+        struct sockaddr_un sa{};
+        const std::string path = s.substr(strlen(UNIX_PREFIX));
+        if (!unix_address(path, &sa))
+            return -1;
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+            return -1;
+        unlink(path.c_str());
+        if (bind(fd, (struct sockaddr *) &sa, sizeof(sa)) < 0 || listen(fd, 16) < 0) {
+            perror("bind/listen");
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    if (starts_with(s, TCP_PREFIX)) {
+        struct addrinfo *ai = tcp_address(s.substr(strlen(TCP_PREFIX)), true);
+        if (ai == nullptr)
+            return -1;
+
+        int fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd >= 0) {
+            int one = 1;
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+            if (bind(fd, ai->ai_addr, ai->ai_addrlen) < 0 || listen(fd, 16) < 0) {
+                perror("bind/listen");
+                close(fd);
+                fd = -1;
+            }
+        }
+        freeaddrinfo(ai);
+        return fd;
+    }
+
+    fprintf(stderr, "Unknown address %s, expected unix:<path> or tcp:<host>:<port>\n", addr);
+    return -1;
+}
+
+int transport_connect(const char *addr) {
+    const std::string s = addr;
+
+    if (starts_with(s, UNIX_PREFIX)) {
+        struct sockaddr_un sa{};
+        if (!unix_address(s.substr(strlen(UNIX_PREFIX)), &sa))
+            return -1;
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+            return -1;
+        if (connect(fd, (struct sockaddr *) &sa, sizeof(sa)) < 0) {
+            perror("connect");
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    if (starts_with(s, TCP_PREFIX)) {
+        struct addrinfo *ai = tcp_address(s.substr(strlen(TCP_PREFIX)), false);
+        if (ai == nullptr)
+            return -1;
+
+        int fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd >= 0 && connect(fd, ai->ai_addr, ai->ai_addrlen) < 0) {
+            perror("connect");
+            close(fd);
+            fd = -1;
+        }
+        if (fd >= 0)
+            set_nodelay(fd);
+        freeaddrinfo(ai);
+        return fd;
+    }
+
+    fprintf(stderr, "Unknown address %s, expected unix:<path> or tcp:<host>:<port>\n", addr);
+    return -1;
+}
+
+bool transport_read_all(int fd, uint8_t *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = read(fd, data, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+bool transport_write_all(int fd, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+bool transport_read_frame(int fd, std::vector<uint8_t> &frame) {
+    auto read = [fd](uint8_t *buffer, size_t len) { return transport_read_all(fd, buffer, len); };
+    return read_sign_bytes(read, frame);
+}
@@ -0,0 +1,39 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///
+/// Loopback transport shared by signer_stub and signer_loadgen
+///
+/// Requests carry the sign bytes exactly as the device receives them (uvarint length prefix + amino vote),
+/// up to SIGN_REQUEST_MAX_SIZE bytes.
+/// Each request is answered with a single sign_status_t byte (signer/signRequest.h).
+///
+
+// addr is "unix:<path>" or "tcp:<host>:<port>". Return a socket or -1.
+int transport_listen(const char *addr);
+int transport_connect(const char *addr);
+
+bool transport_read_all(int fd, uint8_t *data, size_t len);
+bool transport_write_all(int fd, const uint8_t *data, size_t len);
+
+// Reads a length-prefixed request with read_sign_bytes. The prefix is kept at the start of frame.
+bool transport_read_frame(int fd, std::vector<uint8_t> &frame);
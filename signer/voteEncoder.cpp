@@ -0,0 +1,147 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include "lib/vote_parser.h"
+#include "voteEncoder.h"
+
+namespace {
+    // BlockID.Hash, PartSetHeader.Hash and timestamp of real_proposal()
+    const std::vector<uint8_t> PROPOSAL_BLOCK_HASH{
+        130, 250, 74, 141, 138, 59, 64, 89, 2, 14, 37, 169, 26, 68, 218, 149,
+        185, 25, 233, 110, 99, 175, 117, 39, 218, 42, 6, 66, 115, 118, 248, 131};
+    const std::vector<uint8_t> PROPOSAL_PARTS_HASH{
+        35, 52, 252, 117, 251, 228, 106, 244, 94, 202, 53, 155, 96, 99, 0, 168,
+        21, 197, 255, 187, 17, 129, 117, 111, 124, 207, 121, 29, 101, 96, 55, 74};
+    const std::vector<uint8_t> PROPOSAL_TIMESTAMP{8, 164, 152, 150, 227, 5, 16, 167, 135, 203, 41};
+    const char PROPOSAL_CHAIN_ID[] = "testnet";
+
+    void append_fixed64(std::vector<uint8_t> &out, int64_t value) {
+        auto v = (uint64_t) value;
+        for (int i = 0; i < 8; i++) {
+            out.push_back((uint8_t) (v & 0xFF));
+            v >>= 8;
+        }
+    }
+
+    void append_varint(std::vector<uint8_t> &out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back((uint8_t) (value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((uint8_t) value);
+    }
+
+    void append_bytes(std::vector<uint8_t> &out, uint8_t key, const std::vector<uint8_t> &bytes) {
+        out.push_back(key);
+        append_varint(out, bytes.size());
+        out.insert(out.end(), bytes.begin(), bytes.end());
+    }
+
+    // Type, height and round, which vote and proposal share
+    std::vector<uint8_t> hrs_fields(uint8_t type, int64_t height, int64_t round) {
+        std::vector<uint8_t> body;
+
+        body.push_back(0x08);                   // (field_number << 3) | wire_type
+        body.push_back(type);
+        if (height != 0) {
+            body.push_back(0x11);               // (field_number << 3) | wire_type
+            append_fixed64(body, height);
+        }
+        if (round != 0) {
+            body.push_back(0x19);               // (field_number << 3) | wire_type
+            append_fixed64(body, round);
+        }
+
+        return body;
+    }
+
+    std::vector<uint8_t> vote_body(uint8_t type, int64_t height, int64_t round) {
+        std::vector<uint8_t> body = hrs_fields(type, height, round);
+
+        // timestamp
+        body.insert(body.end(), {0x22, 0xb, 0x8, 0x80, 0x92, 0xb8, 0xc3, 0x98, 0xfe, 0xff, 0xff, 0xff, 0x1});
+
+        return body;
+    }
+
+    std::vector<uint8_t> length_prefixed(const std::vector<uint8_t> &body) {
+        std::vector<uint8_t> vote;
+        append_varint(vote, body.size());
+        vote.insert(vote.end(), body.begin(), body.end());
+        return vote;
+    }
+}
+
+std::vector<uint8_t> make_vote(uint8_t type, int64_t height, int64_t round) {
+    return length_prefixed(vote_body(type, height, round));
+}
+
+std::vector<uint8_t> make_vote(uint8_t type, int64_t height, int64_t round, const std::vector<uint8_t> &blockHash) {
+    std::vector<uint8_t> body = vote_body(type, height, round);
+
+    body.push_back(0x2a);                       // (field_number << 3) | wire_type
+    append_varint(body, blockHash.size() + 2);
+    body.push_back(0x0a);                       // (field_number << 3) | wire_type
+    append_varint(body, blockHash.size());
+    body.insert(body.end(), blockHash.begin(), blockHash.end());
+
+    return length_prefixed(body);
+}
+
+std::vector<uint8_t> make_proposal(int64_t height, int64_t round) {
+    return make_proposal(height, round, PROPOSAL_BLOCK_HASH);
+}
+
+std::vector<uint8_t> make_proposal(int64_t height, int64_t round, const std::vector<uint8_t> &blockHash) {
+    std::vector<uint8_t> body = hrs_fields(TYPE_PROPOSAL, height, round);
+
+    // POLRound, -1 when there is no proof of lock
+    body.push_back(0x21);                       // (field_number << 3) | wire_type
+    append_fixed64(body, -1);
+
+    std::vector<uint8_t> partsHeader;
+    append_bytes(partsHeader, 0x0a, PROPOSAL_PARTS_HASH);
+    partsHeader.insert(partsHeader.end(), {0x10, 0x01});    // total
+
+    std::vector<uint8_t> blockId;
+    append_bytes(blockId, 0x0a, blockHash);
+    append_bytes(blockId, 0x12, partsHeader);
+
+    append_bytes(body, 0x2a, blockId);
+    append_bytes(body, 0x32, PROPOSAL_TIMESTAMP);
+    append_bytes(body, 0x3a, std::vector<uint8_t>(PROPOSAL_CHAIN_ID, PROPOSAL_CHAIN_ID + sizeof(PROPOSAL_CHAIN_ID) - 1));
+
+    return length_prefixed(body);
+}
+
+const std::vector<uint8_t> &untyped_vote() {
+    static const std::vector<uint8_t> data{
+        0x0d,
+        0x22, 0xb, 0x8, 0x80, 0x92, 0xb8, 0xc3, 0x98, 0xfe, 0xff, 0xff, 0xff, 0x1};
+    return data;
+}
+
+const std::vector<uint8_t> &real_proposal() {
+    static const std::vector<uint8_t> data{
+        116, 8, 32, 17, 1, 0, 0, 0, 0, 0, 0, 0, 33, 255, 255, 255, 255, 255, 255, 255,
+        255, 42, 72, 10, 32, 130, 250, 74, 141, 138, 59, 64, 89, 2, 14, 37, 169, 26, 68,
+        218, 149, 185, 25, 233, 110, 99, 175, 117, 39, 218, 42, 6, 66, 115, 118, 248,
+        131, 18, 36, 10, 32, 35, 52, 252, 117, 251, 228, 106, 244, 94, 202, 53, 155, 96,
+        99, 0, 168, 21, 197, 255, 187, 17, 129, 117, 111, 124, 207, 121, 29, 101, 96, 55,
+        74, 16, 1, 50, 11, 8, 164, 152, 150, 227, 5, 16, 167, 135, 203, 41, 58, 7, 116,
+        101, 115, 116, 110, 101, 116};
+    return data;
+}
@@ -0,0 +1,43 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+///
+/// Amino encoding of the sign requests a validator receives
+///
+
+// Amino encoded vote with the same layout as the test vectors in tests/val/vote_parser.cpp
+std::vector<uint8_t> make_vote(uint8_t type, int64_t height, int64_t round);
+
+// Same as make_vote, followed by a BlockID with the given hash. Used to build conflicting votes.
+std::vector<uint8_t> make_vote(uint8_t type, int64_t height, int64_t round, const std::vector<uint8_t> &blockHash);
+
+// Amino encoded proposal with the layout of real_proposal(): POLRound -1, a BlockID with its PartSetHeader,
+// timestamp and chain_id "testnet". make_proposal(1, 0) is real_proposal().
+std::vector<uint8_t> make_proposal(int64_t height, int64_t round);
+
+// Same as make_proposal, for another block. Used to build conflicting proposals.
+std::vector<uint8_t> make_proposal(int64_t height, int64_t round, const std::vector<uint8_t> &blockHash);
+
+// Vote without its type field, which vote_amino_parse refuses (VoteParserTest.AllDefaults)
+const std::vector<uint8_t> &untyped_vote();
+
+// Proposal received from a real signatory (VoteParserTest.RealMessageFromSignatory)
+const std::vector<uint8_t> &real_proposal();
@@ -0,0 +1,210 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "lib/vote_fsm.h"
+#include "voteStateStore.h"
+
+namespace {
+    const uint8_t MAGIC[4] = {'T', 'M', 'V', 'S'};
+    const size_t SLOT_SIZE = 64;
+    const size_t CRC_OFFSET = SLOT_SIZE - 4;
+    const size_t FILE_SIZE = 4096;              // one page, so the slots never straddle a page boundary
+
+    typedef struct {
+        uint32_t table[256];
+    } crc32_table_t;
+
+    crc32_table_t make_crc32_table() {
+        crc32_table_t t;
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            }
+            t.table[i] = c;
+        }
+        return t;
+    }
+
+    uint32_t crc32(const uint8_t *data, size_t len) {
+        static const crc32_table_t t = make_crc32_table();
+
+        uint32_t c = 0xFFFFFFFF;
+        for (size_t i = 0; i < len; i++) {
+            c = t.table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+        }
+        return c ^ 0xFFFFFFFF;
+    }
+
+    void put_le(uint8_t *p, uint64_t v, size_t len) {
+        for (size_t i = 0; i < len; i++) {
+            p[i] = (uint8_t) (v >> (8 * i));
+        }
+    }
+
+    uint64_t get_le(const uint8_t *p, size_t len) {
+        uint64_t v = 0;
+        for (size_t i = 0; i < len; i++) {
+            v |= (uint64_t) p[i] << (8 * i);
+        }
+        return v;
+    }
+
+    uint8_t *slot(const vote_state_store_t *store, uint64_t sequence) {
+        return store->map + (sequence % 2) * SLOT_SIZE;
+    }
+
+    // A new file only survives a power loss once its directory entry is on disk
+    bool sync_directory(const char *path) {
+        const std::string file = path;
+        const size_t slash = file.rfind('/');
+        const std::string dir = slash == std::string::npos ? "." : slash == 0 ? "/" : file.substr(0, slash);
+
+        int fd = open(dir.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        const bool ok = fsync(fd) == 0;
+        close(fd);
+        return ok;
+    }
+
+    bool slot_valid(const uint8_t *s) {
+        return memcmp(s, MAGIC, sizeof(MAGIC)) == 0 &&
+               s[4] == VOTE_STATE_STORE_VERSION &&
+               get_le(s + CRC_OFFSET, 4) == crc32(s, CRC_OFFSET);
+    }
+}
+
+bool vote_state_store_open(vote_state_store_t *store, const char *path, uint32_t syncEvery) {
+    store->fd = -1;
+    store->map = nullptr;
+    store->sequence = 0;
+    store->syncEvery = syncEvery;
+    store->pending = 0;
+
+    int fd = open(path, O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+        perror(path);
+        return false;
+    }
+
+    // Two signers sharing a file would each sign from their own copy of vote_state
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        fprintf(stderr, "%s is locked by another signer\n", path);
+        close(fd);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        perror(path);
+        close(fd);
+        return false;
+    }
+
+    if ((size_t) st.st_size < FILE_SIZE) {
+        if (ftruncate(fd, FILE_SIZE) != 0 || fsync(fd) != 0 || !sync_directory(path)) {
+            perror(path);
+            close(fd);
+            return false;
+        }
+    }
+
+    void *map = mmap(nullptr, FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        perror(path);
+        close(fd);
+        return false;
+    }
+
+    store->fd = fd;
+    store->map = (uint8_t *) map;
+
+    for (size_t i = 0; i < 2; i++) {
+        const uint8_t *s = store->map + i * SLOT_SIZE;
+        if (slot_valid(s) && get_le(s + 8, 8) > store->sequence) {
+            store->sequence = get_le(s + 8, 8);
+        }
+    }
+
+    return true;
+}
+
+bool vote_state_store_load(vote_state_store_t *store) {
+    if (store->sequence == 0)
+        return false;
+
+    const uint8_t *s = slot(store, store->sequence);
+    vote_state.isInitialized = s[5];
+    vote_state.vote.Type = s[6];
+    vote_state.vote.Height = (int64_t) get_le(s + 16, 8);
+    vote_state.vote.Round = (int64_t) get_le(s + 24, 8);
+    return true;
+}
+
+bool vote_state_store_save(vote_state_store_t *store) {
+    const uint64_t sequence = store->sequence + 1;
+
+    // Built aside, then copied with a single aligned write
+    alignas(SLOT_SIZE) uint8_t s[SLOT_SIZE] = {};
+    memcpy(s, MAGIC, sizeof(MAGIC));
+    s[4] = VOTE_STATE_STORE_VERSION;
+    s[5] = (uint8_t) vote_state.isInitialized;
+    s[6] = (uint8_t) vote_state.vote.Type;
+    put_le(s + 8, sequence, 8);
+    put_le(s + 16, (uint64_t) vote_state.vote.Height, 8);
+    put_le(s + 24, (uint64_t) vote_state.vote.Round, 8);
+    put_le(s + CRC_OFFSET, crc32(s, CRC_OFFSET), 4);
+
+    memcpy(slot(store, sequence), s, SLOT_SIZE);
+    store->sequence = sequence;
+
+    store->pending++;
+    if (store->syncEvery > 0 && store->pending >= store->syncEvery)
+        return vote_state_store_sync(store);
+    return true;
+}
+
+bool vote_state_store_sync(vote_state_store_t *store) {
+    store->pending = 0;
+    if (msync(store->map, FILE_SIZE, MS_SYNC) != 0) {
+        perror("msync");
+        return false;
+    }
+    return true;
+}
+
+void vote_state_store_close(vote_state_store_t *store) {
+    if (store->map != nullptr) {
+        if (store->pending > 0) {
+            vote_state_store_sync(store);
+        }
+        munmap(store->map, FILE_SIZE);
+        store->map = nullptr;
+    }
+    if (store->fd >= 0) {
+        close(store->fd);
+        store->fd = -1;
+    }
+}
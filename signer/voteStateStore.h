@@ -0,0 +1,64 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+///
+/// Crash-safe copy of vote_state on the host, so that a restarted signer keeps refusing what it already signed
+///
+/// The file is mapped with mmap and holds two 64-byte slots (little endian):
+///   magic       4 bytes  "TMVS"
+///   version     1 byte   VOTE_STATE_STORE_VERSION
+///   initialized 1 byte   vote_state.isInitialized
+///   type        1 byte   vote_state.vote.Type
+///   reserved    1 byte
+///   sequence    8 bytes  incremented on every save
+///   height      8 bytes  vote_state.vote.Height
+///   round       8 bytes  vote_state.vote.Round
+///   reserved    28 bytes
+///   crc32       4 bytes  of the 60 bytes above
+///
+/// Saves alternate between the slots, each one a single aligned 64-byte write. A save torn by a crash fails its
+/// checksum and the other slot, one transition older, is loaded instead.
+///
+
+#define VOTE_STATE_STORE_VERSION 1
+
+typedef struct {
+    int fd;
+    uint8_t *map;
+    uint64_t sequence;          // sequence of the newest valid slot, 0 if there is none
+    uint32_t syncEvery;         // msync after this many saves. 0 leaves write-back to the OS until close, which
+                                // survives a crash of the process but not of the host
+    uint32_t pending;           // saves since the last msync
+} vote_state_store_t;
+
+// Opens or creates the file at path, and locks it for this process. Fails if another store holds the lock.
+bool vote_state_store_open(vote_state_store_t *store, const char *path, uint32_t syncEvery);
+
+// Copies the newest valid slot into vote_state. Returns false, leaving vote_state as it is, if there is none.
+bool vote_state_store_load(vote_state_store_t *store);
+
+// Writes vote_state to the older slot, then syncs if syncEvery saves are pending
+bool vote_state_store_save(vote_state_store_t *store);
+
+// Flushes pending saves to disk
+bool vote_state_store_sync(vote_state_store_t *store);
+
+// Syncs pending saves and unmaps the file
+void vote_state_store_close(vote_state_store_t *store);
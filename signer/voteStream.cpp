@@ -0,0 +1,199 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include <fstream>
+#include <random>
+#include "lib/vote_parser.h"
+#include "signRequest.h"
+#include "voteEncoder.h"
+#include "voteStream.h"
+
+namespace {
+    const char MAGIC[4] = {'T', 'M', 'C', 'S'};
+
+    class StreamBuilder {
+    public:
+        StreamBuilder(const stream_options_t &opt) : opt_(opt), rng_(opt.seed), percent_(0, 99) {}
+
+        bool chance(unsigned pct) {
+            return percent_(rng_) < pct;
+        }
+
+        int64_t uniform(int64_t from, int64_t to) {
+            std::uniform_int_distribution<int64_t> dist(from, to);
+            return dist(rng_);
+        }
+
+        // Appends a request that moves the state forward, then any refused requests that follow it
+        void fresh(uint8_t type, int64_t height, int64_t round) {
+            signedIdx_.push_back(stream_.size());
+            push(request(type, height, round), sign_accepted);
+
+            if (chance(opt_.duplicates)) {
+                push(stream_[signedIdx_.back()].data, sign_rejected);
+            }
+
+            if (chance(opt_.stale)) {
+                const size_t idx = (size_t) uniform(0, signedIdx_.size() - 1);
+                push(stream_[signedIdx_[idx]].data, sign_rejected);
+            }
+
+            if (chance(opt_.equivocations)) {
+                std::vector<uint8_t> blockHash(32);
+                for (auto &b : blockHash) {
+                    b = (uint8_t) uniform(0, 255);
+                }
+                push(request(type, height, round, blockHash), sign_rejected);
+            }
+
+            if (chance(opt_.malformed)) {
+                push(untyped_vote(), sign_invalid);
+            }
+        }
+
+        std::vector<stream_request_t> &stream() {
+            return stream_;
+        }
+
+    private:
+        static std::vector<uint8_t> request(uint8_t type, int64_t height, int64_t round) {
+            return type == TYPE_PROPOSAL ? make_proposal(height, round) : make_vote(type, height, round);
+        }
+
+        static std::vector<uint8_t> request(uint8_t type, int64_t height, int64_t round,
+                                            const std::vector<uint8_t> &blockHash) {
+            return type == TYPE_PROPOSAL ? make_proposal(height, round, blockHash)
+                                         : make_vote(type, height, round, blockHash);
+        }
+
+        void push(const std::vector<uint8_t> &data, sign_status_t expected) {
+            stream_.push_back(stream_request_t{data, expected});
+        }
+
+        const stream_options_t &opt_;
+        std::mt19937 rng_;
+        std::uniform_int_distribution<unsigned> percent_;
+        std::vector<stream_request_t> stream_;
+        std::vector<size_t> signedIdx_;
+    };
+
+    bool read_bytes(std::istream &in, uint8_t *data, size_t len) {
+        in.read((char *) data, len);
+        return (size_t) in.gcount() == len;
+    }
+}
+
+bool stream_options_valid(const stream_options_t &opt) {
+    return opt.heights >= 1 && opt.heights <= STREAM_MAX_HEIGHTS &&
+           opt.rounds >= 1 && opt.rounds <= STREAM_MAX_ROUNDS &&
+           opt.roundChange < 100 &&
+           opt.heightJump <= 100 &&
+           opt.duplicates <= 100 &&
+           opt.stale <= 100 &&
+           opt.equivocations <= 100 &&
+           opt.malformed <= 100;
+}
+
+std::vector<stream_request_t> generate_stream(const stream_options_t &opt) {
+    if (!stream_options_valid(opt))
+        return std::vector<stream_request_t>();
+
+    StreamBuilder builder(opt);
+
+    int64_t height = 1;
+    for (int64_t i = 0; i < opt.heights; i++) {
+        int64_t round = 0;
+        while (true) {
+            builder.fresh(TYPE_PROPOSAL, height, round);
+            builder.fresh(TYPE_PREVOTE, height, round);
+
+            if (round + 1 >= opt.rounds && !builder.chance(opt.roundChange)) {
+                builder.fresh(TYPE_PRECOMMIT, height, round);
+                break;
+            }
+
+            // The round fails, sometimes after precommitting, and consensus moves to the next round
+            if (builder.chance(50)) {
+                builder.fresh(TYPE_PRECOMMIT, height, round);
+            }
+            round++;
+        }
+
+        height += builder.chance(opt.heightJump) ? builder.uniform(2, 100) : 1;
+    }
+
+    return builder.stream();
+}
+
+bool write_stream(const std::string &path, const std::vector<stream_request_t> &stream) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out.is_open())
+        return false;
+
+    const uint8_t version = CONSENSUS_STREAM_VERSION;
+    const auto count = (uint32_t) stream.size();
+    const uint8_t countLE[4] = {
+        (uint8_t) count, (uint8_t) (count >> 8), (uint8_t) (count >> 16), (uint8_t) (count >> 24)};
+
+    out.write(MAGIC, sizeof(MAGIC));
+    out.write((const char *) &version, 1);
+    out.write((const char *) countLE, sizeof(countLE));
+
+    for (const auto &req : stream) {
+        const auto status = (uint8_t) req.expected;
+        out.write((const char *) &status, 1);
+        out.write((const char *) req.data.data(), req.data.size());
+    }
+
+    return out.good();
+}
+
+bool read_stream(const std::string &path, std::vector<stream_request_t> &stream) {
+    stream.clear();
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open())
+        return false;
+
+    char magic[4];
+    uint8_t version;
+    uint8_t countLE[4];
+    in.read(magic, sizeof(magic));
+    if (!in.good() || std::string(magic, 4) != std::string(MAGIC, 4))
+        return false;
+    if (!read_bytes(in, &version, 1) || version != CONSENSUS_STREAM_VERSION)
+        return false;
+    if (!read_bytes(in, countLE, sizeof(countLE)))
+        return false;
+
+    // count is not trusted for reserve: a corrupt header fails on the first missing request instead
+    const uint32_t count = countLE[0] | (countLE[1] << 8) | (countLE[2] << 16) | ((uint32_t) countLE[3] << 24);
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint8_t status;
+        if (!read_bytes(in, &status, 1) || status > sign_invalid)
+            return false;
+
+        std::vector<uint8_t> data;
+        auto read = [&in](uint8_t *buffer, size_t len) { return read_bytes(in, buffer, len); };
+        if (!read_sign_bytes(read, data))
+            return false;
+
+        stream.push_back(stream_request_t{data, (sign_status_t) status});
+    }
+
+    return true;
+}
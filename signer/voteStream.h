@@ -0,0 +1,68 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "signRequest.h"
+
+///
+/// Synthetic consensus streams for the validator state machine
+///
+/// File format (little endian):
+///   magic    4 bytes  "TMCS"
+///   version  1 byte   CONSENSUS_STREAM_VERSION
+///   count    4 bytes  number of requests
+///   count x  request:
+///     status 1 byte   expected sign_status_t
+///     data   amino sign bytes, self-delimited by their uvarint length prefix (SIGN_REQUEST_MAX_SIZE at most)
+///
+
+#define CONSENSUS_STREAM_VERSION 2
+
+#define STREAM_MAX_HEIGHTS 1000000
+#define STREAM_MAX_ROUNDS 1000
+
+typedef struct {
+    std::vector<uint8_t> data;
+    sign_status_t expected;
+} stream_request_t;
+
+typedef struct {
+    uint32_t seed = 0;
+    int64_t heights = 1000;         // number of heights visited
+    int64_t rounds = 1;             // rounds each height goes through before it can commit
+    unsigned roundChange = 10;      // % of rounds that fail and move to the next round (below 100)
+    unsigned heightJump = 2;        // % of heights followed by a jump of up to 100 heights
+    unsigned duplicates = 5;        // % of requests repeated right away
+    unsigned stale = 5;             // % of requests followed by an older one
+    unsigned equivocations = 2;     // % of requests followed by a vote for another block at the same HRS
+    unsigned malformed = 1;         // % of requests followed by one that fails to parse
+} stream_options_t;
+
+// Percentages are at most 100 and roundChange is below 100, so that every height commits
+bool stream_options_valid(const stream_options_t &opt);
+
+// Proposal and prevote for every round, and a precommit for the round that commits, with round changes and
+// height jumps. Duplicates, stale requests and equivocation attempts are mixed in and are expected to be
+// sign_rejected; malformed requests are expected to be sign_invalid.
+// Returns an empty stream if the options are not valid.
+std::vector<stream_request_t> generate_stream(const stream_options_t &opt);
+
+bool write_stream(const std::string &path, const std::vector<stream_request_t> &stream);
+bool read_stream(const std::string &path, std::vector<stream_request_t> &stream);
@@ -0,0 +1,198 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "lib/vote_fsm.h"
+#include "lib/vote_parser.h"
+#include "../../signer/signRequest.h"
+#include "../../signer/voteEncoder.h"
+#include "../../signer/voteStream.h"
+
+namespace {
+    // Replays the stream and returns the index of the first request whose decision differs, or -1
+    int64_t first_mismatch(const std::vector<stream_request_t> &stream) {
+        vote_reset();
+        vote_state_reset();
+
+        for (size_t i = 0; i < stream.size(); i++) {
+            const auto status = sign_request(stream[i].data.data(), stream[i].data.size());
+            if (status != stream[i].expected)
+                return (int64_t) i;
+        }
+        return -1;
+    }
+
+    TEST(ConsensusStreamTest, OnlyFreshRequests) {
+        stream_options_t opt;
+        opt.heights = 100;
+        opt.duplicates = 0;
+        opt.stale = 0;
+        opt.equivocations = 0;
+        opt.malformed = 0;
+
+        auto stream = generate_stream(opt);
+        ASSERT_FALSE(stream.empty());
+        for (const auto &req : stream) {
+            EXPECT_EQ(sign_accepted, req.expected);
+        }
+
+        EXPECT_EQ(-1, first_mismatch(stream));
+    }
+
+    TEST(ConsensusStreamTest, RefusesDuplicatesStaleEquivocationsAndMalformed) {
+        stream_options_t opt;
+        opt.seed = 1;
+        opt.heights = 2000;
+        opt.duplicates = 20;
+        opt.stale = 20;
+        opt.equivocations = 20;
+        opt.malformed = 20;
+
+        auto stream = generate_stream(opt);
+
+        size_t refused = 0;
+        size_t invalid = 0;
+        for (const auto &req : stream) {
+            refused += req.expected == sign_rejected ? 1 : 0;
+            invalid += req.expected == sign_invalid ? 1 : 0;
+        }
+        EXPECT_GT(refused, 0u);
+        EXPECT_GT(invalid, 0u);
+
+        EXPECT_EQ(-1, first_mismatch(stream)) << "FSM decision differs from the generated stream";
+    }
+
+    TEST(ConsensusStreamTest, RoundsPerHeight) {
+        stream_options_t opt;
+        opt.heights = 10;
+        opt.rounds = 3;
+        opt.roundChange = 0;
+        opt.heightJump = 0;
+        opt.duplicates = 0;
+        opt.stale = 0;
+        opt.equivocations = 0;
+        opt.malformed = 0;
+
+        // Proposal and prevote for every round, plus the precommit of the last round and of about half the others
+        auto stream = generate_stream(opt);
+        EXPECT_GE(stream.size(), 10u * 7);
+        EXPECT_LE(stream.size(), 10u * 9);
+        EXPECT_EQ(make_proposal(1, 0), stream.front().data);
+        EXPECT_EQ(make_vote(TYPE_PRECOMMIT, 10, 2), stream.back().data);
+
+        EXPECT_EQ(-1, first_mismatch(stream));
+    }
+
+    TEST(ConsensusStreamTest, ProposalEncoding) {
+        EXPECT_EQ(real_proposal(), make_proposal(1, 0));
+
+        vote_reset();
+        vote_state_reset();
+        const auto proposal = make_proposal(5, 3);
+        EXPECT_EQ(sign_accepted, sign_request(proposal.data(), proposal.size()));
+        EXPECT_EQ(sign_invalid, sign_request(untyped_vote().data(), untyped_vote().size()));
+    }
+
+    TEST(ConsensusStreamTest, InvalidOptions) {
+        // Every round failing would never reach the next height
+        stream_options_t opt;
+        opt.roundChange = 100;
+        EXPECT_FALSE(stream_options_valid(opt));
+        EXPECT_TRUE(generate_stream(opt).empty());
+
+        opt = stream_options_t();
+        opt.duplicates = 101;
+        EXPECT_FALSE(stream_options_valid(opt));
+
+        opt = stream_options_t();
+        opt.malformed = 101;
+        EXPECT_FALSE(stream_options_valid(opt));
+
+        opt = stream_options_t();
+        opt.heights = 0;
+        EXPECT_FALSE(stream_options_valid(opt));
+
+        opt = stream_options_t();
+        opt.rounds = 0;
+        EXPECT_FALSE(stream_options_valid(opt));
+
+        EXPECT_TRUE(stream_options_valid(stream_options_t()));
+    }
+
+    TEST(ConsensusStreamTest, SameSeedSameStream) {
+        stream_options_t opt;
+        opt.seed = 7;
+        opt.heights = 50;
+
+        auto a = generate_stream(opt);
+        auto b = generate_stream(opt);
+
+        ASSERT_EQ(a.size(), b.size());
+        for (size_t i = 0; i < a.size(); i++) {
+            EXPECT_EQ(a[i].data, b[i].data);
+            EXPECT_EQ(a[i].expected, b[i].expected);
+        }
+    }
+
+    TEST(ConsensusStreamTest, FileRoundTrip) {
+        stream_options_t opt;
+        opt.seed = 3;
+        opt.heights = 200;
+
+        const std::string path = testing::TempDir() + "consensus_stream_test.bin";
+        auto stream = generate_stream(opt);
+        ASSERT_TRUE(write_stream(path, stream));
+
+        std::vector<stream_request_t> loaded;
+        ASSERT_TRUE(read_stream(path, loaded));
+
+        ASSERT_EQ(stream.size(), loaded.size());
+        for (size_t i = 0; i < stream.size(); i++) {
+            EXPECT_EQ(stream[i].data, loaded[i].data);
+            EXPECT_EQ(stream[i].expected, loaded[i].expected);
+        }
+
+        std::remove(path.c_str());
+    }
+
+    TEST(ConsensusStreamTest, CorruptFile) {
+        const std::string path = testing::TempDir() + "consensus_stream_corrupt.bin";
+
+        // Maximum request count, then a single request announcing 2^35 - 1 bytes
+        const uint8_t data[] = {
+            'T', 'M', 'C', 'S', CONSENSUS_STREAM_VERSION,
+            0xff, 0xff, 0xff, 0xff,
+            0x00, 0xff, 0xff, 0xff, 0xff, 0x7f};
+        {
+            std::ofstream out(path, std::ios::binary);
+            out.write((const char *) data, sizeof(data));
+        }
+
+        std::vector<stream_request_t> loaded;
+        EXPECT_FALSE(read_stream(path, loaded));
+
+        std::remove(path.c_str());
+    }
+
+    TEST(ConsensusStreamTest, MissingFile) {
+        std::vector<stream_request_t> loaded;
+        EXPECT_FALSE(read_stream(testing::TempDir() + "does_not_exist.bin", loaded));
+    }
+}
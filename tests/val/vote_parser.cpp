@@ -60,6 +60,91 @@ namespace {
         EXPECT_EQ(9, pos);
     }
 
+    TEST(VoteParserTest, ReadVarints_Truncated) {
+        size_t value;
+        uint32_t pos = 0;
+
+        // 300 without its last byte
+        std::vector<uint8_t> short_data{0xac};
+        auto err = get_varint(short_data.data(), short_data.size(), &value, pos, &pos);
+        EXPECT_EQ(parse_unexpected_buffer_end, err);
+        EXPECT_EQ(1, pos);
+
+        // 2959127534 without its last byte
+        std::vector<uint8_t> long_data{0xee, 0xe7, 0x82, 0x83};
+        pos = 0;
+        err = get_varint(long_data.data(), long_data.size(), &value, pos, &pos);
+        EXPECT_EQ(parse_unexpected_buffer_end, err);
+        EXPECT_EQ(4, pos);
+
+        // Valid varint followed by a truncated one
+        std::vector<uint8_t> mixed_data{0x34, 0xac};
+        pos = 0;
+        err = get_varint(mixed_data.data(), mixed_data.size(), &value, pos, &pos);
+        EXPECT_EQ(parse_ok, err);
+        EXPECT_EQ(0x34, value);
+        EXPECT_EQ(1, pos);
+
+        err = get_varint(mixed_data.data(), mixed_data.size(), &value, pos, &pos);
+        EXPECT_EQ(parse_unexpected_buffer_end, err);
+        EXPECT_EQ(2, pos);
+    }
+
+    TEST(VoteParserTest, ReadVarints_Overlong) {
+        size_t value;
+        uint32_t pos = 0;
+
+        // Non-minimal encodings (padded with 0x80 groups) decode to the same value
+        std::vector<uint8_t> varint_data{
+                0x80, 0x00,             // 0
+                0xb4, 0x80, 0x00,       // 0x34
+                0xac, 0x82, 0x80, 0x00  // 300
+        };
+
+        auto err = get_varint(varint_data.data(), varint_data.size(), &value, pos, &pos);
+        EXPECT_EQ(parse_ok, err);
+        EXPECT_EQ(0, value);
+        EXPECT_EQ(2, pos);
+
+        err = get_varint(varint_data.data(), varint_data.size(), &value, pos, &pos);
+        EXPECT_EQ(parse_ok, err);
+        EXPECT_EQ(0x34, value);
+        EXPECT_EQ(5, pos);
+
+        err = get_varint(varint_data.data(), varint_data.size(), &value, pos, &pos);
+        EXPECT_EQ(parse_ok, err);
+        EXPECT_EQ(300, value);
+        EXPECT_EQ(9, pos);
+    }
+
+    TEST(VoteParserTest, ReadVarints_Sequence) {
+        // Every encoded length from 1 to 5 bytes, read back to back
+        const std::vector<size_t> values{
+                0, 1, 0x7F,
+                0x80, 0x3FFF,
+                0x4000, 0x1FFFFF,
+                0x200000, 0xFFFFFFF,
+                0x10000000, 2959127534, 0xFFFFFFFF};
+
+        std::vector<uint8_t> varint_data;
+        for (auto v : values) {
+            while (v >= 0x80) {
+                varint_data.push_back((uint8_t) (v | 0x80));
+                v >>= 7;
+            }
+            varint_data.push_back((uint8_t) v);
+        }
+
+        size_t value;
+        uint32_t pos = 0;
+        for (auto expected : values) {
+            auto err = get_varint(varint_data.data(), varint_data.size(), &value, pos, &pos);
+            EXPECT_EQ(parse_ok, err);
+            EXPECT_EQ(expected, value);
+        }
+        EXPECT_EQ(varint_data.size(), pos);
+    }
+
 
     TEST(VoteParserTest, Empty) {
         std::vector<uint8_t> vote_data{};
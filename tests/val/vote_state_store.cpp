@@ -0,0 +1,152 @@
+/*******************************************************************************
+*   (c) 2019 ZondaX GmbH
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "lib/vote_fsm.h"
+#include "lib/vote_parser.h"
+#include "../../signer/voteStateStore.h"
+
+namespace {
+    void set_state(uint8_t type, int64_t height, int64_t round) {
+        vote_state_reset();
+        vote_state.isInitialized = 1;
+        vote_state.vote.Type = type;
+        vote_state.vote.Height = height;
+        vote_state.vote.Round = round;
+    }
+
+    void corrupt(const std::string &path, size_t offset) {
+        std::fstream f(path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(offset);
+        f.put((char) 0xAA);
+    }
+
+    std::string state_file(const char *name) {
+        const std::string path = testing::TempDir() + name;
+        std::remove(path.c_str());
+        return path;
+    }
+
+    TEST(VoteStateStoreTest, NewFile) {
+        const std::string path = state_file("vote_state_new.bin");
+
+        vote_state_store_t store;
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 1));
+        EXPECT_FALSE(vote_state_store_load(&store));
+        vote_state_store_close(&store);
+
+        std::remove(path.c_str());
+    }
+
+    TEST(VoteStateStoreTest, OneSignerPerFile) {
+        const std::string path = state_file("vote_state_locked.bin");
+
+        vote_state_store_t store;
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 1));
+
+        vote_state_store_t other;
+        EXPECT_FALSE(vote_state_store_open(&other, path.c_str(), 1));
+
+        vote_state_store_close(&store);
+        ASSERT_TRUE(vote_state_store_open(&other, path.c_str(), 1));
+        vote_state_store_close(&other);
+
+        std::remove(path.c_str());
+    }
+
+    TEST(VoteStateStoreTest, RestoresLastSave) {
+        const std::string path = state_file("vote_state_restore.bin");
+
+        vote_state_store_t store;
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 0));
+        set_state(TYPE_PREVOTE, 10, 0);
+        ASSERT_TRUE(vote_state_store_save(&store));
+        set_state(TYPE_PRECOMMIT, 12, 3);
+        ASSERT_TRUE(vote_state_store_save(&store));
+        vote_state_store_close(&store);
+
+        vote_state_reset();
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 0));
+        ASSERT_TRUE(vote_state_store_load(&store));
+        vote_state_store_close(&store);
+
+        EXPECT_EQ(1, vote_state.isInitialized);
+        EXPECT_EQ(TYPE_PRECOMMIT, vote_state.vote.Type);
+        EXPECT_EQ(12, vote_state.vote.Height);
+        EXPECT_EQ(3, vote_state.vote.Round);
+
+        std::remove(path.c_str());
+    }
+
+    TEST(VoteStateStoreTest, TornSaveFallsBackToPreviousSlot) {
+        const std::string path = state_file("vote_state_torn.bin");
+
+        vote_state_store_t store;
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 1));
+        set_state(TYPE_PREVOTE, 10, 0);
+        ASSERT_TRUE(vote_state_store_save(&store));
+        set_state(TYPE_PRECOMMIT, 10, 0);
+        ASSERT_TRUE(vote_state_store_save(&store));
+        vote_state_store_close(&store);
+
+        // The second save went to the first slot. Damage its height.
+        corrupt(path, 20);
+
+        vote_state_reset();
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 1));
+        ASSERT_TRUE(vote_state_store_load(&store));
+        EXPECT_EQ(TYPE_PREVOTE, vote_state.vote.Type);
+        EXPECT_EQ(10, vote_state.vote.Height);
+
+        // Saving again overwrites the damaged slot
+        set_state(TYPE_PROPOSAL, 11, 0);
+        ASSERT_TRUE(vote_state_store_save(&store));
+        vote_state_store_close(&store);
+
+        vote_state_reset();
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 1));
+        ASSERT_TRUE(vote_state_store_load(&store));
+        EXPECT_EQ(TYPE_PROPOSAL, vote_state.vote.Type);
+        EXPECT_EQ(11, vote_state.vote.Height);
+        vote_state_store_close(&store);
+
+        std::remove(path.c_str());
+    }
+
+    TEST(VoteStateStoreTest, BothSlotsDamaged) {
+        const std::string path = state_file("vote_state_damaged.bin");
+
+        vote_state_store_t store;
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 1));
+        set_state(TYPE_PREVOTE, 10, 0);
+        ASSERT_TRUE(vote_state_store_save(&store));
+        set_state(TYPE_PRECOMMIT, 10, 0);
+        ASSERT_TRUE(vote_state_store_save(&store));
+        vote_state_store_close(&store);
+
+        corrupt(path, 20);
+        corrupt(path, 64 + 20);
+
+        ASSERT_TRUE(vote_state_store_open(&store, path.c_str(), 1));
+        EXPECT_FALSE(vote_state_store_load(&store));
+        vote_state_store_close(&store);
+
+        std::remove(path.c_str());
+    }
+}